@@ -27,13 +27,34 @@
 #include <QLabel>
 #include <QScreen>
 
+// API root; override with PRICEDESK_API_BASE or the "apiBase" setting
+// (e.g. http://127.0.0.1:8080/api/v3 for the mock server in mockserver/)
+static QString apiBase() {
+    static const QString base = []() {
+        QString b = qEnvironmentVariable("PRICEDESK_API_BASE");
+        if (b.isEmpty()) b = QSettings("Demo", "CryptoOverlay").value("apiBase").toString();
+        if (b.isEmpty()) b = "https://api.coingecko.com/api/v3";
+        while (b.endsWith('/')) b.chop(1);
+        return b;
+    }();
+    return base;
+}
+// PRICEDESK_REFRESH_MS polling interval, 0 when unset; soak tests against the
+// mock server poll far faster than the settings dialog allows
+static int refreshOverrideMs() {
+    return qMax(0, qEnvironmentVariableIntValue("PRICEDESK_REFRESH_MS"));
+}
 static QString apiSimplePrice(const QString& ids, const QString& vs_currencies) {
-    return QString("https://api.coingecko.com/api/v3/simple/price?ids=%1&vs_currencies=%2")
-            .arg(ids, vs_currencies);
+    return QString("%1/simple/price?ids=%2&vs_currencies=%3")
+            .arg(apiBase(), ids, vs_currencies);
 }
 static QString apiMarketChart(const QString& id, const QString& vs_currency, int days) {
-    return QString("https://api.coingecko.com/api/v3/coins/%1/market_chart?vs_currency=%2&days=%3")
-            .arg(id, vs_currency).arg(days);
+    return QString("%1/coins/%2/market_chart?vs_currency=%3&days=%4")
+            .arg(apiBase(), id, vs_currency).arg(days);
+}
+static QString apiMarkets(const QString& vs_currency, const QString& ids) {
+    return QString("%1/coins/markets?vs_currency=%2&ids=%3&price_change_percentage=1h,24h,7d")
+            .arg(apiBase(), vs_currency, ids);
 }
 
 // Simple lightweight chart widget (draws a line chart)
@@ -258,10 +279,7 @@ private slots:
     void fetchForCurrency(const QString &currency) {
         const QString ids = coinIds.join(",");
         // use markets endpoint which supports percent changes per currency
-        const QString url = QString(
-            "https://api.coingecko.com/api/v3/coins/markets?"
-            "vs_currency=%1&ids=%2&price_change_percentage=1h,24h,7d"
-        ).arg(currency, ids);
+        const QString url = apiMarkets(currency, ids);
 
         QNetworkRequest req{ QUrl(url) };
         auto reply = manager->get(QNetworkRequest(QUrl(url)));
@@ -485,6 +503,10 @@ public:
         refreshSpin->setRange(10000, 3600000);
         refreshSpin->setSingleStep(5000);
         refreshSpin->setValue(overlay->refreshInterval());
+        if (refreshOverrideMs() > 0) {
+            refreshSpin->setEnabled(false);
+            refreshSpin->setToolTip(QString("Overridden by PRICEDESK_REFRESH_MS (%1 ms)").arg(refreshOverrideMs()));
+        }
         posXSpin = new QSpinBox(); posYSpin = new QSpinBox();
         posXSpin->setRange(-10000, 10000); posYSpin->setRange(-10000,10000);
         QPoint p = overlay->pos();
@@ -543,7 +565,7 @@ public:
         if (vs.isEmpty()) vs = QStringList() << "usd";
         overlay->setVsCurrencies(vs);
 
-        overlay->setRefreshInterval(refreshSpin->value());
+        if (refreshOverrideMs() == 0) overlay->setRefreshInterval(refreshSpin->value());
         overlay->move(posXSpin->value(), posYSpin->value());
 
         // alarms
@@ -610,6 +632,7 @@ int main(int argc, char *argv[])
     QString coins = s.value("coins", "dogecoin").toString();
     QString vs = s.value("vs", "usd").toString();
     int refresh = s.value("refresh", 1990000).toInt();
+    if (refreshOverrideMs() > 0) refresh = refreshOverrideMs();
     int px = s.value("posx", 20).toInt();
     int py = s.value("posy", 300).toInt();
     QString alarms = s.value("alarms", "").toString();
@@ -0,0 +1,615 @@
+// mockserver/main.cpp
+// Local stand-in for the CoinGecko v3 API so priceDesk can run offline and be
+// soak-tested. Prices follow a geometric random walk; latency, errors and 429
+// throttling can be injected from the command line.
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QHostAddress>
+#include <QTimer>
+#include <QPointer>
+#include <QUrl>
+#include <QUrlQuery>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QDateTime>
+#include <QHash>
+#include <QQueue>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+static const double kSecondsPerYear = 365.0 * 24 * 3600;
+static const int kHistoryHours = 168;   // hourly samples kept per coin (7 days)
+
+struct SimConfig {
+    int coinCount = 100;
+    int tickMs = 1000;
+    double drift = 0.0;         // annualised
+    double volatility = 0.8;    // annualised
+    double timeScale = 1.0;     // simulated seconds per wall-clock second
+    quint64 seed = 42;
+    bool strict = false;        // unknown ids are "not found" instead of created on demand
+    int latencyMs = 0;
+    int jitterMs = 0;
+    double errorRate = 0.0;     // fraction of requests answered with 500
+    double throttleRate = 0.0;  // fraction of requests answered with 429
+    int rateLimit = 0;          // requests per minute before 429, 0 = unlimited
+};
+
+struct Coin {
+    QString id;
+    QString symbol;
+    QString name;
+    double price;       // usd
+    double supply;
+    double volume;      // usd, 24h
+};
+
+// Random-walk market on a simulated clock; all prices are kept in usd and
+// converted on output. Each coin keeps its price at every hour boundary of the
+// last 7 simulated days, which feeds both the percent changes and the charts.
+class MarketSim {
+public:
+    explicit MarketSim(const SimConfig& c)
+        : cfg(c), rng(c.seed), simSec(QDateTime::currentMSecsSinceEpoch() / 1000.0)
+    {
+        struct Seed { const char* id; const char* symbol; const char* name; double price; };
+        static const Seed seeds[] = {
+            {"bitcoin", "btc", "Bitcoin", 65000.0},
+            {"ethereum", "eth", "Ethereum", 3200.0},
+            {"binancecoin", "bnb", "BNB", 580.0},
+            {"solana", "sol", "Solana", 150.0},
+            {"ripple", "xrp", "XRP", 0.52},
+            {"dogecoin", "doge", "Dogecoin", 0.15},
+            {"cardano", "ada", "Cardano", 0.45},
+            {"litecoin", "ltc", "Litecoin", 80.0},
+            {"polkadot", "dot", "Polkadot", 7.0},
+            {"monero", "xmr", "Monero", 160.0},
+        };
+        const int seedCount = int(sizeof(seeds) / sizeof(seeds[0]));
+
+        coins.reserve(qMax(cfg.coinCount, seedCount));
+        samples.reserve(qMax(cfg.coinCount, seedCount) * kSlots);
+        for (int i = 0; i < cfg.coinCount; ++i) {
+            if (i < seedCount) {
+                addCoin(seeds[i].id, seeds[i].symbol, seeds[i].name, seeds[i].price);
+            } else {
+                const QString id = QString("coin-%1").arg(i, 6, 10, QChar('0'));
+                addCoin(id, QString("c%1").arg(i), QString("Coin %1").arg(i), randomPrice(id));
+            }
+        }
+
+        fx.insert("usd", 1.0);
+        fx.insert("eur", 0.92);
+        fx.insert("gbp", 0.79);
+        fx.insert("jpy", 150.0);
+        fx.insert("cad", 1.36);
+        fx.insert("aud", 1.52);
+        fx.insert("chf", 0.88);
+        fx.insert("cny", 7.2);
+        fx.insert("inr", 83.0);
+        fx.insert("krw", 1350.0);
+    }
+
+    // advance the clock by dt simulated seconds, sampling every hour boundary crossed
+    void tick(double dt) {
+        const double end = simSec + dt;
+        for (;;) {
+            const double next = (std::floor(simSec / 3600) + 1) * 3600;
+            const double stop = qMin(next, end);
+            if (stop > simSec) advance(stop - simSec);
+            simSec = stop;
+            if (stop < next) break;
+            const qint64 h = qint64(next / 3600);
+            for (int i = 0; i < coins.size(); ++i) sample(i, h) = coins[i].price;
+        }
+        ranksDirty = true;
+    }
+
+    // index of coin id, creating it on demand unless running strict; -1 if unknown
+    int indexOf(const QString& id) {
+        auto it = index.constFind(id);
+        if (it != index.constEnd()) return it.value();
+        if (cfg.strict || id.isEmpty()) return -1;
+        return addCoin(id, id.left(4), id, randomPrice(id));
+    }
+
+    int count() const { return coins.size(); }
+    const Coin& coin(int i) const { return coins[i]; }
+    qint64 nowMs() const { return qint64(simSec * 1000); }
+
+    // coin indices ordered by market cap, largest first
+    const QVector<int>& byMarketCap() {
+        if (ranksDirty) {
+            order.resize(coins.size());
+            for (int i = 0; i < order.size(); ++i) order[i] = i;
+            std::sort(order.begin(), order.end(), [this](int a, int b) {
+                return coins[a].price * coins[a].supply > coins[b].price * coins[b].supply;
+            });
+            ranks.resize(order.size());
+            for (int k = 0; k < order.size(); ++k) ranks[order[k]] = k + 1;
+            ranksDirty = false;
+        }
+        return order;
+    }
+    int rank(int i) {
+        byMarketCap();
+        return ranks[i];
+    }
+
+    // usd price of coin i the given simulated seconds ago (at most 7 days),
+    // interpolated between hourly samples
+    double priceAgo(int i, double seconds) const {
+        const double t = simSec - seconds;
+        const qint64 last = lastHour();
+        const double t0 = last * 3600.0;
+        if (t >= t0) {
+            const double f = simSec > t0 ? (t - t0) / (simSec - t0) : 1.0;
+            return sample(i, last) + (coins[i].price - sample(i, last)) * f;
+        }
+        const qint64 h = qMax(last - kHistoryHours, qint64(std::floor(t / 3600)));
+        const double f = qBound(0.0, (t - h * 3600.0) / 3600, 1.0);
+        return sample(i, h) + (sample(i, h + 1) - sample(i, h)) * f;
+    }
+
+    // units of vs per usd; crypto denominations follow the simulated price
+    bool rate(const QString& vs, double* out) const {
+        if (fx.contains(vs)) { *out = fx.value(vs); return true; }
+        const char* ref = vs == "btc" ? "bitcoin" : vs == "eth" ? "ethereum" : nullptr;
+        if (!ref || !index.contains(ref)) return false;
+        *out = 1.0 / coins[index.value(ref)].price;
+        return true;
+    }
+
+    // hourly points for the last `days` (daily beyond 90 days, as CoinGecko does),
+    // ending at the current price. The stored 7 days come from the samples; older
+    // points continue the walk backwards from the oldest sample. days <= 3650.
+    QVector<QPair<qint64,double>> history(int i, double days) const {
+        const double start = simSec - days * 86400;
+        const qint64 last = lastHour();
+        const qint64 oldest = last - kHistoryHours;
+        const qint64 first = qint64(std::ceil(start / 3600));
+        const int stride = days > 90 ? 24 : 1;
+
+        QVector<QPair<qint64,double>> out;
+        if (first < oldest) {
+            // seeded by the oldest stored hour so it only changes when the store rolls over
+            std::mt19937_64 local(cfg.seed ^ qHash(coins[i].id) ^ quint64(oldest));
+            QVector<double> older(int(oldest - first));
+            double p = sample(i, oldest);
+            for (int k = older.size() - 1; k >= 0; --k) {
+                p /= step(local, 3600);
+                older[k] = p;
+            }
+            for (int k = 0; k < older.size(); ++k) {
+                if ((first + k) % stride == 0) out.append(qMakePair((first + k) * 3600000, older[k]));
+            }
+        }
+        for (qint64 h = qMax(first, oldest); h <= last; ++h) {
+            if (h % stride == 0) out.append(qMakePair(h * 3600000, sample(i, h)));
+        }
+        if (out.isEmpty()) out.append(qMakePair(qint64(start * 1000), priceAgo(i, days * 86400)));
+        out.append(qMakePair(nowMs(), coins[i].price));
+        return out;
+    }
+
+private:
+    static const int kSlots = kHistoryHours + 1;   // hour boundaries last-168 .. last
+
+    qint64 lastHour() const { return qint64(std::floor(simSec / 3600)); }
+    double& sample(int i, qint64 h) { return samples[i * kSlots + int(h % kSlots)]; }
+    double sample(int i, qint64 h) const { return samples[i * kSlots + int(h % kSlots)]; }
+
+    void advance(double dt) {
+        for (Coin& c : coins) {
+            c.price *= step(rng, dt);
+            c.volume *= step(rng, dt);
+        }
+    }
+
+    template <typename Rng>
+    double step(Rng& g, double dtSec) const {
+        const double dt = dtSec / kSecondsPerYear;
+        const double s = cfg.volatility;
+        std::normal_distribution<double> z(0.0, 1.0);
+        return std::exp((cfg.drift - 0.5 * s * s) * dt + s * std::sqrt(dt) * z(g));
+    }
+
+    double randomPrice(const QString& id) const {
+        std::mt19937_64 local(cfg.seed ^ qHash(id));
+        std::uniform_real_distribution<double> e(-6.0, 8.0);
+        return std::exp(e(local));
+    }
+
+    // new coins get a backfilled week of hourly samples so the percent changes
+    // and charts are meaningful from the first request
+    int addCoin(const QString& id, const QString& symbol, const QString& name, double price) {
+        std::uniform_real_distribution<double> u(0.0, 1.0);
+        Coin c;
+        c.id = id;
+        c.symbol = symbol;
+        c.name = name;
+        c.price = price;
+        c.supply = std::pow(10.0, 6 + 5 * u(rng));
+        c.volume = c.supply * price * (0.01 + 0.1 * u(rng));
+        coins.append(c);
+        const int i = coins.size() - 1;
+        index.insert(id, i);
+
+        samples.resize(samples.size() + kSlots);
+        const qint64 last = lastHour();
+        double p = price / step(rng, simSec - last * 3600.0);
+        for (qint64 h = last; h >= last - kHistoryHours; --h) {
+            sample(i, h) = p;
+            p /= step(rng, 3600);
+        }
+        ranksDirty = true;
+        return i;
+    }
+
+    SimConfig cfg;
+    std::mt19937_64 rng;
+    double simSec;              // simulated clock, seconds since epoch
+    QVector<Coin> coins;
+    QVector<double> samples;    // kSlots per coin, ring indexed by epoch hour
+    QHash<QString,int> index;
+    QHash<QString,double> fx;
+    QVector<int> order;
+    QVector<int> ranks;
+    bool ranksDirty = true;
+};
+
+// Minimal HTTP/1.1 server (GET only, keep-alive, one request in flight per connection)
+class MockServer : public QTcpServer {
+public:
+    MockServer(MarketSim* sim, const SimConfig& c, QObject* parent=nullptr)
+        : QTcpServer(parent), sim(sim), cfg(c), rng(c.seed + 1) {}
+
+    struct Stats { quint64 requests = 0, ok = 0, throttled = 0, failed = 0; };
+    Stats stats() const { return counters; }
+
+protected:
+    void incomingConnection(qintptr fd) override {
+        QTcpSocket* s = new QTcpSocket(this);
+        if (!s->setSocketDescriptor(fd)) {
+            s->deleteLater();
+            return;
+        }
+        connect(s, &QTcpSocket::readyRead, this, [this, s]() {
+            conns[s].buffer += s->readAll();
+            processNext(s);
+        });
+        connect(s, &QTcpSocket::disconnected, this, [this, s]() {
+            conns.remove(s);
+            s->deleteLater();
+        });
+    }
+
+private:
+    struct Conn { QByteArray buffer; bool busy = false; };
+    struct Response { int status = 200; QByteArray body; QByteArray headers; };
+
+    void processNext(QTcpSocket* s) {
+        Conn& c = conns[s];
+        if (c.busy) return;
+        const int end = c.buffer.indexOf("\r\n\r\n");
+        if (end < 0) {
+            if (c.buffer.size() > 64 * 1024) s->abort();
+            return;
+        }
+        const QList<QByteArray> lines = c.buffer.left(end).split('\n');
+        c.buffer.remove(0, end + 4);
+
+        const QList<QByteArray> req = lines.first().trimmed().split(' ');
+        if (req.size() < 3) {
+            s->abort();
+            return;
+        }
+        bool keepAlive = req[2] == "HTTP/1.1";
+        for (int i = 1; i < lines.size(); ++i) {
+            const QByteArray ln = lines[i].trimmed().toLower();
+            if (ln.startsWith("connection:")) keepAlive = ln.contains("keep-alive");
+        }
+
+        c.busy = true;
+        ++counters.requests;
+        const Response r = req[0] == "GET" ? handle(QString::fromUtf8(req[1]))
+                                           : error(405, "mock: only GET is supported");
+        if (r.status < 300) ++counters.ok;
+        else if (r.status == 429) ++counters.throttled;
+        else ++counters.failed;
+
+        int delay = cfg.latencyMs;
+        if (cfg.jitterMs > 0) delay += std::uniform_int_distribution<int>(0, cfg.jitterMs)(rng);
+
+        QPointer<QTcpSocket> ps(s);
+        QTimer::singleShot(delay, this, [this, ps, r, keepAlive]() {
+            if (!ps || ps->state() != QAbstractSocket::ConnectedState) return;
+            send(ps, r, keepAlive);
+            if (!keepAlive) {
+                ps->disconnectFromHost();
+                return;
+            }
+            conns[ps].busy = false;
+            processNext(ps);
+        });
+    }
+
+    void send(QTcpSocket* s, const Response& r, bool keepAlive) {
+        static const QHash<int,QByteArray> reasons = {
+            {200, "OK"}, {400, "Bad Request"}, {404, "Not Found"},
+            {405, "Method Not Allowed"}, {429, "Too Many Requests"},
+            {500, "Internal Server Error"},
+        };
+        QByteArray out = "HTTP/1.1 " + QByteArray::number(r.status) + ' ' + reasons.value(r.status) + "\r\n";
+        out += "Content-Type: application/json; charset=utf-8\r\n";
+        out += "Content-Length: " + QByteArray::number(r.body.size()) + "\r\n";
+        out += keepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+        out += r.headers;
+        out += "\r\n";
+        out += r.body;
+        s->write(out);
+    }
+
+    // --- fault injection, then routing ---
+    Response handle(const QString& target) {
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        if (cfg.rateLimit > 0) {
+            while (!recent.isEmpty() && now - recent.head() >= 60000) recent.dequeue();
+            if (recent.size() >= cfg.rateLimit) {
+                const qint64 wait = (60000 - (now - recent.head())) / 1000 + 1;
+                return throttled(wait);
+            }
+            recent.enqueue(now);
+        }
+
+        std::uniform_real_distribution<double> u(0.0, 1.0);
+        if (cfg.throttleRate > 0 && u(rng) < cfg.throttleRate) return throttled(60);
+        if (cfg.errorRate > 0 && u(rng) < cfg.errorRate) return error(500, "mock: injected server error");
+
+        const QUrl url(target);
+        const QUrlQuery q(url);
+        QString path = url.path();
+        if (path.startsWith("/api/v3")) path.remove(0, 7);
+        while (path.endsWith('/')) path.chop(1);
+
+        if (path == "/ping") return json(QJsonObject{{"gecko_says", "(V3) To the Moon!"}});
+        if (path == "/coins/list") return coinsList();
+        if (path == "/coins/markets") return markets(q);
+        if (path == "/simple/price") return simplePrice(q);
+
+        const QStringList parts = path.split('/', QString::SkipEmptyParts);
+        if (parts.size() == 3 && parts[0] == "coins" && parts[2] == "market_chart")
+            return marketChart(parts[1], q);
+
+        return error(404, "mock: unknown endpoint");
+    }
+
+    Response coinsList() {
+        QJsonArray arr;
+        for (int i = 0; i < sim->count(); ++i) {
+            const Coin& c = sim->coin(i);
+            arr.append(QJsonObject{{"id", c.id}, {"symbol", c.symbol}, {"name", c.name}});
+        }
+        return json(arr);
+    }
+
+    // /coins/markets: pages over the requested ids, or all coins by market cap
+    Response markets(const QUrlQuery& q) {
+        const QString vs = q.queryItemValue("vs_currency", QUrl::FullyDecoded).toLower();
+        if (vs.isEmpty()) return error(400, "Missing parameter vs_currency");
+        double rate;
+        if (!sim->rate(vs, &rate)) return error(400, "invalid vs_currency");
+
+        QVector<int> sel;
+        const QStringList ids = q.queryItemValue("ids", QUrl::FullyDecoded).split(',', QString::SkipEmptyParts);
+        if (ids.isEmpty()) {
+            sel = sim->byMarketCap();
+        } else {
+            for (const QString& id : ids) {
+                const int i = sim->indexOf(id.trimmed().toLower());
+                if (i >= 0) sel.append(i);
+            }
+        }
+
+        bool ok;
+        int perPage = q.queryItemValue("per_page").toInt(&ok);
+        perPage = ok ? qBound(1, perPage, 250) : 100;
+        int page = q.queryItemValue("page").toInt(&ok);
+        page = ok ? qMax(1, page) : 1;
+        const QStringList changes = q.queryItemValue("price_change_percentage", QUrl::FullyDecoded)
+                                        .split(',', QString::SkipEmptyParts);
+
+        const QString updated = QDateTime::fromMSecsSinceEpoch(sim->nowMs(), Qt::UTC).toString(Qt::ISODateWithMs);
+        QJsonArray arr;
+        const int first = (page - 1) * perPage;
+        for (int k = first; k < sel.size() && k < first + perPage; ++k) {
+            const Coin& c = sim->coin(sel[k]);
+            const double price = c.price * rate;
+            const double open24h = sim->priceAgo(sel[k], 86400);
+            QJsonObject o{
+                {"id", c.id}, {"symbol", c.symbol}, {"name", c.name},
+                {"current_price", price},
+                {"market_cap", price * c.supply},
+                {"market_cap_rank", sim->rank(sel[k])},
+                {"total_volume", c.volume * rate},
+                {"circulating_supply", c.supply},
+                {"price_change_24h", (c.price - open24h) * rate},
+                {"price_change_percentage_24h", pct(c.price, open24h)},
+                {"last_updated", updated},
+            };
+            for (const QString& ch : changes) {
+                const QString key = QString("price_change_percentage_%1_in_currency").arg(ch.trimmed());
+                if (ch == "1h") o.insert(key, pct(c.price, sim->priceAgo(sel[k], 3600)));
+                else if (ch == "24h") o.insert(key, pct(c.price, open24h));
+                else if (ch == "7d") o.insert(key, pct(c.price, sim->priceAgo(sel[k], 7 * 86400)));
+                else o.insert(key, QJsonValue::Null);
+            }
+            arr.append(o);
+        }
+        return json(arr);
+    }
+
+    // /simple/price: unknown ids and currencies are left out, as upstream does
+    Response simplePrice(const QUrlQuery& q) {
+        const QStringList ids = q.queryItemValue("ids", QUrl::FullyDecoded).split(',', QString::SkipEmptyParts);
+        const QStringList vs = q.queryItemValue("vs_currencies", QUrl::FullyDecoded).split(',', QString::SkipEmptyParts);
+        if (ids.isEmpty() || vs.isEmpty()) return error(400, "Missing parameter ids or vs_currencies");
+        const bool withCap = q.queryItemValue("include_market_cap") == "true";
+        const bool withVol = q.queryItemValue("include_24hr_vol") == "true";
+        const bool withChange = q.queryItemValue("include_24hr_change") == "true";
+        const bool withUpdated = q.queryItemValue("include_last_updated_at") == "true";
+
+        QJsonObject out;
+        for (const QString& rawId : ids) {
+            const int i = sim->indexOf(rawId.trimmed().toLower());
+            if (i < 0) continue;
+            const Coin& c = sim->coin(i);
+            QJsonObject o;
+            for (const QString& rawVs : vs) {
+                const QString cur = rawVs.trimmed().toLower();
+                double rate;
+                if (!sim->rate(cur, &rate)) continue;
+                o.insert(cur, c.price * rate);
+                if (withCap) o.insert(cur + "_market_cap", c.price * c.supply * rate);
+                if (withVol) o.insert(cur + "_24h_vol", c.volume * rate);
+                if (withChange) o.insert(cur + "_24h_change", pct(c.price, sim->priceAgo(i, 86400)));
+            }
+            if (withUpdated) o.insert("last_updated_at", sim->nowMs() / 1000);
+            out.insert(c.id, o);
+        }
+        return json(out);
+    }
+
+    Response marketChart(const QString& id, const QUrlQuery& q) {
+        const int i = sim->indexOf(id.toLower());
+        if (i < 0) return error(404, "coin not found");
+        const QString vs = q.queryItemValue("vs_currency", QUrl::FullyDecoded).toLower();
+        double rate;
+        if (vs.isEmpty() || !sim->rate(vs, &rate)) return error(400, "invalid vs_currency");
+        const QString daysStr = q.queryItemValue("days");
+        bool ok = true;
+        double days = daysStr == "max" ? 3650 : daysStr.toDouble(&ok);
+        if (!ok || !std::isfinite(days) || days <= 0) return error(400, "invalid days");
+        days = qMin(days, 3650.0);
+
+        const Coin& c = sim->coin(i);
+        QJsonArray prices, caps, volumes;
+        for (const auto& pt : sim->history(i, days)) {
+            const double p = pt.second * rate;
+            prices.append(QJsonArray{double(pt.first), p});
+            caps.append(QJsonArray{double(pt.first), p * c.supply});
+            volumes.append(QJsonArray{double(pt.first), c.volume * rate});
+        }
+        return json(QJsonObject{{"prices", prices}, {"market_caps", caps}, {"total_volumes", volumes}});
+    }
+
+    static double pct(double now, double then) { return (now / then - 1.0) * 100.0; }
+
+    static Response json(const QJsonObject& o) {
+        Response r;
+        r.body = QJsonDocument(o).toJson(QJsonDocument::Compact);
+        return r;
+    }
+    static Response json(const QJsonArray& a) {
+        Response r;
+        r.body = QJsonDocument(a).toJson(QJsonDocument::Compact);
+        return r;
+    }
+    static Response error(int status, const QString& msg) {
+        Response r = json(QJsonObject{{"error", msg}});
+        r.status = status;
+        return r;
+    }
+    static Response throttled(qint64 retryAfter) {
+        Response r = json(QJsonObject{{"status", QJsonObject{
+            {"error_code", 429},
+            {"error_message", "You've exceeded the Rate Limit (mock)."},
+        }}});
+        r.status = 429;
+        r.headers = "Retry-After: " + QByteArray::number(retryAfter) + "\r\n";
+        return r;
+    }
+
+    MarketSim* sim;
+    SimConfig cfg;
+    std::mt19937_64 rng;
+    QHash<QTcpSocket*, Conn> conns;
+    QQueue<qint64> recent;
+    Stats counters;
+};
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName("priceDeskMock");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Local CoinGecko-compatible mock server for priceDesk.");
+    parser.addHelpOption();
+
+    QCommandLineOption hostOpt("host", "Address to listen on.", "addr", "127.0.0.1");
+    QCommandLineOption portOpt("port", "Port to listen on.", "port", "8080");
+    QCommandLineOption coinsOpt("coins", "Number of coins to generate.", "n", "100");
+    QCommandLineOption strictOpt("strict", "Return not found for unknown coin ids instead of creating them.");
+    QCommandLineOption seedOpt("seed", "Random seed.", "n", "42");
+    QCommandLineOption tickOpt("tick-ms", "Price update interval.", "ms", "1000");
+    QCommandLineOption driftOpt("drift", "Annualised drift of the random walk.", "mu", "0");
+    QCommandLineOption volOpt("volatility", "Annualised volatility of the random walk.", "sigma", "0.8");
+    QCommandLineOption scaleOpt("time-scale", "Simulated seconds per real second.", "x", "1");
+    QCommandLineOption latencyOpt("latency-ms", "Fixed delay added to every response.", "ms", "0");
+    QCommandLineOption jitterOpt("jitter-ms", "Random extra delay, uniform in [0, ms].", "ms", "0");
+    QCommandLineOption errorOpt("error-rate", "Fraction of requests answered with 500.", "p", "0");
+    QCommandLineOption throttleOpt("throttle-rate", "Fraction of requests answered with 429.", "p", "0");
+    QCommandLineOption limitOpt("rate-limit", "Requests per minute before answering 429 (0 = off).", "n", "0");
+    QCommandLineOption statsOpt("stats-s", "Print request counters every n seconds (0 = off).", "n", "10");
+    parser.addOptions({hostOpt, portOpt, coinsOpt, strictOpt, seedOpt, tickOpt, driftOpt, volOpt,
+                       scaleOpt, latencyOpt, jitterOpt, errorOpt, throttleOpt, limitOpt, statsOpt});
+    parser.process(a);
+
+    SimConfig cfg;
+    cfg.coinCount = qMax(0, parser.value(coinsOpt).toInt());
+    cfg.strict = parser.isSet(strictOpt);
+    cfg.seed = parser.value(seedOpt).toULongLong();
+    cfg.tickMs = qMax(1, parser.value(tickOpt).toInt());
+    cfg.drift = parser.value(driftOpt).toDouble();
+    cfg.volatility = qMax(0.0, parser.value(volOpt).toDouble());
+    cfg.timeScale = qMax(0.0, parser.value(scaleOpt).toDouble());
+    cfg.latencyMs = qMax(0, parser.value(latencyOpt).toInt());
+    cfg.jitterMs = qMax(0, parser.value(jitterOpt).toInt());
+    cfg.errorRate = qBound(0.0, parser.value(errorOpt).toDouble(), 1.0);
+    cfg.throttleRate = qBound(0.0, parser.value(throttleOpt).toDouble(), 1.0);
+    cfg.rateLimit = qMax(0, parser.value(limitOpt).toInt());
+
+    MarketSim sim(cfg);
+    MockServer server(&sim, cfg);
+    const QString host = parser.value(hostOpt);
+    const quint16 port = quint16(parser.value(portOpt).toUInt());
+    if (!server.listen(QHostAddress(host), port)) {
+        qCritical().noquote() << "listen failed:" << server.errorString();
+        return 1;
+    }
+    qInfo().noquote() << QString("Serving %1 coins at http://%2:%3/api/v3")
+                             .arg(sim.count()).arg(host).arg(server.serverPort());
+
+    QTimer tick;
+    QObject::connect(&tick, &QTimer::timeout, [&]() {
+        sim.tick(cfg.tickMs / 1000.0 * cfg.timeScale);
+    });
+    tick.start(cfg.tickMs);
+
+    QTimer report;
+    QObject::connect(&report, &QTimer::timeout, [&]() {
+        const MockServer::Stats st = server.stats();
+        qInfo().noquote() << QString("requests %1, ok %2, 429 %3, errors %4")
+                                 .arg(st.requests).arg(st.ok).arg(st.throttled).arg(st.failed);
+    });
+    const int statsS = parser.value(statsOpt).toInt();
+    if (statsS > 0) report.start(statsS * 1000);
+
+    return a.exec();
+}